@@ -143,7 +143,8 @@ static inline float3 lut_sample_tetra(const Lut3D& lut, const float3& in){
 }
 
 // Convert input to DaVinciWG + Davinci Intermediate (encoded), using OpenDRT matrices + transfer decode.
-static inline float3 input_to_dwg_intermediate(const float3& rgb_in, int inGamutIdx, int inOetfIdx){
+// M_in_to_xyz is the input gamut matrix, looked up once per render by the caller.
+static inline float3 input_to_dwg_intermediate(const float3& rgb_in, const Mat3& M_in_to_xyz, int inOetfIdx){
     // Decode input transfer to linear
     float3 lin = {
         decode_input_oetf(inOetfIdx, rgb_in.x),
@@ -152,12 +153,10 @@ static inline float3 input_to_dwg_intermediate(const float3& rgb_in, int inGamut
     };
 
     // Convert input gamut -> XYZ
-    Mat3 M_in_to_xyz = inputGamutToXYZ(inGamutIdx);
     float3 xyz = mat_apply(M_in_to_xyz, lin);
 
     // Convert XYZ -> DaVinciWG (linear)
-    Mat3 M_xyz_to_dwg = xyzToDaVinciWG();
-    float3 dwg_lin = mat_apply(M_xyz_to_dwg, xyz);
+    float3 dwg_lin = mat_apply(xyzToDaVinciWG(), xyz);
 
     // Encode to Davinci Intermediate (0..~)
     float3 dwg_di = {
@@ -182,8 +181,7 @@ static inline float3 dwg_di_to_rec709_24(const float3& dwg_di){
     float3 xyz = mat_apply(matrix_davinciwg_to_xyz, dwg_lin);
 
     // XYZ -> Rec709 linear
-    Mat3 M_xyz_to_rec709 = xyzToRec709();
-    float3 rec_lin = mat_apply(M_xyz_to_rec709, xyz);
+    float3 rec_lin = mat_apply(xyzToRec709(), xyz);
 
     // Encode Rec709 2.4
     float3 rec_24 = { encode_rec709_24(rec_lin.x), encode_rec709_24(rec_lin.y), encode_rec709_24(rec_lin.z) };
@@ -260,6 +258,14 @@ private:
         const Lut3D sepLut   = get_sep_lut(sepChoice);
         const Lut3D printLut = get_print_lut(printChoice);
 
+        // LUTs and the input matrix depend only on LUT choice and input gamut.
+        // Blends enter the pixel loop purely as lerp weights, so keyframed
+        // blend values need no per-frame preparation beyond these clamps.
+        const Mat3  inToXyz = inputGamutToXYZ(inGamut);
+        const float negT    = clampf(negBlend, 0.0f, 1.0f);
+        const float sepT    = clampf(sepBlend, 0.0f, 1.0f);
+        const float printT  = clampf(printBlend, 0.0f, 1.0f);
+
         for(int y = procWindow.y1; y < procWindow.y2; ++y) {
             if(_effect.abort()) break;
 
@@ -271,7 +277,7 @@ private:
                 float  a_in   = (nComp == 4) ? srcPix[3] : 1.0f;
 
                 // 1) Color-manage to DWG+DI
-                float3 dwg_di = input_to_dwg_intermediate(rgb_in, inGamut, inOetf);
+                float3 dwg_di = input_to_dwg_intermediate(rgb_in, inToXyz, inOetf);
 
                 // 2) Negative (luma LUT) in DWG+DI
                 float3 after_neg = dwg_di;
@@ -282,14 +288,14 @@ private:
                     float Y2 = luma_rec709(lutOut);
                     float scale = (Y > 1e-6f) ? (Y2 / Y) : 1.0f;
                     float3 scaled = dwg_di * scale;
-                    after_neg = lerp3(dwg_di, scaled, clampf(negBlend, 0.0f, 1.0f));
+                    after_neg = lerp3(dwg_di, scaled, negT);
                 }
 
                 // 3) Color separation LUT in DWG+DI
                 float3 after_sep = after_neg;
                 if(sepEnable){
                     float3 sepOut = lut_sample_tetra(sepLut, after_neg);
-                    after_sep = lerp3(after_neg, sepOut, clampf(sepBlend, 0.0f, 1.0f));
+                    after_sep = lerp3(after_neg, sepOut, sepT);
                 }
 
                 // 4) Print stage in output space (Rec709 2.4 baseline vs Kodak LUT)
@@ -299,7 +305,7 @@ private:
                 if(printEnable){
                     // Kodak LUT assumed to take DWG+DI and output Rec709-ish
                     float3 kodak = lut_sample_tetra(printLut, after_sep);
-                    out_rgb = lerp3(baseline, kodak, clampf(printBlend, 0.0f, 1.0f));
+                    out_rgb = lerp3(baseline, kodak, printT);
                 }
 
                 dstPix[0] = out_rgb.x;
@@ -372,20 +378,22 @@ private:
         proc.setSrcImg(src.get());
         proc.setRenderWindow(args.renderWindow);
 
-        // Read params
-                _pInGamut->getValue(proc.inGamut);
-        _pInOetf->getValue(proc.inOetf);
-proc.negEnable = _pNegEnable->getValue();
-                _pNegLut->getValue(proc.negChoice);
-proc.negBlend  = (float)_pNegBlend->getValue();
+        // Read params at the frame being rendered; frames may render concurrently
+        const double t = args.time;
+        _pInGamut->getValueAtTime(t, proc.inGamut);
+        _pInOetf->getValueAtTime(t, proc.inOetf);
+
+        proc.negEnable = _pNegEnable->getValueAtTime(t);
+        _pNegLut->getValueAtTime(t, proc.negChoice);
+        proc.negBlend  = (float)_pNegBlend->getValueAtTime(t);
 
-        proc.sepEnable = _pSepEnable->getValue();
-                _pSepStyle->getValue(proc.sepChoice);
-proc.sepBlend  = (float)_pSepBlend->getValue();
+        proc.sepEnable = _pSepEnable->getValueAtTime(t);
+        _pSepStyle->getValueAtTime(t, proc.sepChoice);
+        proc.sepBlend  = (float)_pSepBlend->getValueAtTime(t);
 
-        proc.printEnable = _pPrintEnable->getValue();
-                _pPrintLut->getValue(proc.printChoice);
-proc.printBlend  = (float)_pPrintBlend->getValue();
+        proc.printEnable = _pPrintEnable->getValueAtTime(t);
+        _pPrintLut->getValueAtTime(t, proc.printChoice);
+        proc.printBlend  = (float)_pPrintBlend->getValueAtTime(t);
 
         proc.process();
     }
@@ -402,8 +410,11 @@ public:
         desc.addSupportedContext(OFX::eContextFilter);
         desc.addSupportedBitDepth(OFX::eBitDepthFloat);
 
+        // render() keeps all state in a per-call processor and only reads the
+        // const LUT tables and matrices, so one instance may render frames in parallel.
+        desc.setRenderThreadSafety(OFX::eRenderFullySafe);
         desc.setSingleInstance(false);
-        desc.setHostFrameThreading(false);
+        desc.setHostFrameThreading(true);
         desc.setSupportsMultiResolution(true);
         desc.setSupportsTiles(true);
         desc.setRenderTwiceAlways(false);
@@ -88,7 +88,11 @@ static inline Mat3 inputGamutToXYZ(int idx){
   }
 }
 
-static inline Mat3 xyzToDaVinciWG(){ static Mat3 inv = inv3(matrix_davinciwg_to_xyz); return inv; }
-static inline Mat3 xyzToRec709(){ static Mat3 inv = inv3(matrix_rec709_to_xyz); return inv; }
+// Inverses are built once at load time, before any render thread can run.
+static const Mat3 matrix_xyz_to_davinciwg = inv3(matrix_davinciwg_to_xyz);
+static const Mat3 matrix_xyz_to_rec709 = inv3(matrix_rec709_to_xyz);
+
+static inline const Mat3& xyzToDaVinciWG(){ return matrix_xyz_to_davinciwg; }
+static inline const Mat3& xyzToRec709(){ return matrix_xyz_to_rec709; }
 
 
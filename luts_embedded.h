@@ -1,5 +1,8 @@
 #pragma once
 #include <cstddef>
+// Tables are const and live in the module's read-only data, so every process
+// that loads the plugin maps the same file-backed pages; samplers reference
+// them in place and no per-process copies or derived tables are built.
 namespace EmbeddedLUTs {
 static constexpr int LUT_SIZE = 33;
 extern const float LUT_NEG_CTHULHU[];